@@ -0,0 +1,37 @@
+program BenchAppend;
+{ Character-at-a-time string building: `s := s + chr(...)`, the shape
+  generated code uses for every string it assembles.  Each append copies
+  the whole string today, so a round is quadratic in its length.
+  Baseline for in-place self-append (plan.md §12.18). }
+
+const
+  ROUNDS = 40;
+  N = 5000;
+
+var
+  t0, t1: double;
+  checkResult: integer;
+
+function Kernel: integer;
+var
+  r, i, acc: integer;
+  s: string;
+begin
+  acc := 0;
+  for r := 1 to ROUNDS do
+  begin
+    s := '';
+    for i := 1 to N do
+      s := s + chr(ord('a') + (i * 7 + r) mod 26);
+    acc := (acc + length(s) + ord(s[(r * 97) mod N + 1])) mod 1000003;
+  end;
+  Kernel := acc;
+end;
+
+begin
+  t0 := RealTimeClock();
+  checkResult := Kernel;
+  t1 := RealTimeClock();
+  writeln('check=', checkResult);
+  writeln('elapsed_s=', (t1 - t0):0:6);
+end.
@@ -0,0 +1,78 @@
+program BenchEnums;
+{ Enum-typed state machine: one transition function call, a case over the
+  state, enum comparisons, succ/pred and enum assignment per iteration.
+  Enum values are heap EnumObj cells today, so every copy, compare and
+  return goes through a pointer and a refcount.  Baseline for inline enum
+  ordinals (plan.md §12.7). }
+
+const
+  ITERS = 300000;
+
+type
+  TState = (stIdle, stScan, stToken, stEmit, stFlush);
+
+var
+  t0, t1: double;
+  checkResult: integer;
+
+function NextState(s: TState; input: integer): TState;
+begin
+  case s of
+    stIdle:
+      begin
+        if input mod 3 = 0 then NextState := stScan
+        else NextState := stIdle;
+      end;
+    stScan:
+      begin
+        if input mod 5 < 2 then NextState := stToken
+        else NextState := stScan;
+      end;
+    stToken:
+      NextState := stEmit;
+    stEmit:
+      begin
+        if input mod 7 = 0 then NextState := stFlush
+        else NextState := stScan;
+      end;
+    stFlush:
+      NextState := stIdle;
+  end;
+end;
+
+function Kernel: integer;
+var
+  st: TState;
+  i, x, acc, emitted, idles, flushes: integer;
+begin
+  st := stIdle;
+  x := 1;
+  acc := 0;
+  emitted := 0;
+  idles := 0;
+  flushes := 0;
+  for i := 1 to ITERS do
+  begin
+    x := (x * 1103 + 12345) mod 65536;
+    st := NextState(st, x);
+    if st = stEmit then
+      emitted := emitted + 1;
+    if st > stScan then
+      acc := (acc + ord(st) * i) mod 1000003;
+    if st <> stFlush then
+      if succ(st) = stScan then
+        idles := idles + 1;
+    if st <> stIdle then
+      if pred(st) = stEmit then
+        flushes := flushes + 1;
+  end;
+  Kernel := (acc + emitted * 7 + idles * 13 + flushes * 17 + ord(st)) mod 1000003;
+end;
+
+begin
+  t0 := RealTimeClock();
+  checkResult := Kernel;
+  t1 := RealTimeClock();
+  writeln('check=', checkResult);
+  writeln('elapsed_s=', (t1 - t0):0:6);
+end.
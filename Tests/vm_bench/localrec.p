@@ -0,0 +1,53 @@
+program BenchLocalRec;
+{ Small local records that never escape: a complex-number-style multiply
+  on two-field records, with a whole-record assignment every iteration.
+  Each local record is a heap RecordObj today, each field store an address
+  push plus SET_INDIRECT, and `a := c` a record copy.  Baseline for scalar
+  replacement of local records (plan.md §12.13). }
+
+const
+  ITERS = 200000;
+
+type
+  TVec = record
+    x: integer;
+    y: integer;
+  end;
+
+var
+  t0, t1: double;
+  checkResult: integer;
+
+function Kernel: integer;
+var
+  a, b, c: TVec;
+  i, acc: integer;
+begin
+  a.x := 1;
+  a.y := 2;
+  b.x := 3;
+  b.y := 5;
+  acc := 0;
+  for i := 1 to ITERS do
+  begin
+    c.x := (a.x * b.x - a.y * b.y) mod 10007;
+    c.y := (a.x * b.y + a.y * b.x) mod 10007;
+    a := c;
+    if a.x < 0 then
+      a.x := a.x + 10007;
+    if a.y < 0 then
+      a.y := a.y + 10007;
+    b.x := (b.x + i) mod 101;
+    b.y := (b.y * 3 + 1) mod 97;
+    acc := (acc + a.x + a.y) mod 1000003;
+  end;
+  Kernel := acc;
+end;
+
+begin
+  t0 := RealTimeClock();
+  checkResult := Kernel;
+  t1 := RealTimeClock();
+  writeln('check=', checkResult);
+  writeln('elapsed_s=', (t1 - t0):0:6);
+end.
@@ -0,0 +1,76 @@
+program BenchParticles;
+{ Integer particles bouncing in a box: a global fixed array of
+  four-field records, every field read and written through a[i].f on
+  each step.  Each element is its own heap RecordObj today, so a step
+  walks NP separate objects.  Baseline for packed arrays of scalar
+  records (plan.md §12.16). }
+
+const
+  NP = 1000;
+  STEPS = 300;
+  W = 10000;
+  H = 8000;
+
+type
+  TParticle = record
+    x: integer;
+    y: integer;
+    vx: integer;
+    vy: integer;
+  end;
+
+var
+  parts: array[1..NP] of TParticle;
+  t0, t1: double;
+  checkResult: integer;
+
+function Kernel: integer;
+var
+  i, s, acc: integer;
+begin
+  for i := 1 to NP do
+  begin
+    parts[i].x := (i * 37) mod W;
+    parts[i].y := (i * 91) mod H;
+    parts[i].vx := (i mod 13) - 6;
+    parts[i].vy := (i mod 11) - 5;
+  end;
+  for s := 1 to STEPS do
+    for i := 1 to NP do
+    begin
+      parts[i].x := parts[i].x + parts[i].vx;
+      if parts[i].x < 0 then
+      begin
+        parts[i].x := -parts[i].x;
+        parts[i].vx := -parts[i].vx;
+      end
+      else if parts[i].x >= W then
+      begin
+        parts[i].x := 2 * (W - 1) - parts[i].x;
+        parts[i].vx := -parts[i].vx;
+      end;
+      parts[i].y := parts[i].y + parts[i].vy;
+      if parts[i].y < 0 then
+      begin
+        parts[i].y := -parts[i].y;
+        parts[i].vy := -parts[i].vy;
+      end
+      else if parts[i].y >= H then
+      begin
+        parts[i].y := 2 * (H - 1) - parts[i].y;
+        parts[i].vy := -parts[i].vy;
+      end;
+    end;
+  acc := 0;
+  for i := 1 to NP do
+    acc := (acc * 31 + parts[i].x + parts[i].y * 7) mod 1000003;
+  Kernel := acc;
+end;
+
+begin
+  t0 := RealTimeClock();
+  checkResult := Kernel;
+  t1 := RealTimeClock();
+  writeln('check=', checkResult);
+  writeln('elapsed_s=', (t1 - t0):0:6);
+end.
@@ -0,0 +1,84 @@
+program BenchPointers;
+{ Linked-list pointer chasing: repeated traversals of a heap-allocated
+  list, a var-parameter update of every node, and a pointer passed to and
+  returned from a function each round.  Every pointer copy (p := p^.next,
+  by-value pointer parameters, the var-parameter address) allocates a
+  fresh PointerObj today.  Baseline for immediate pointers
+  (plan.md §12.8). }
+
+const
+  NODES = 1000;
+  ROUNDS = 600;
+
+type
+  PNode = ^TNode;
+  TNode = record
+    val: integer;
+    next: PNode;
+  end;
+
+var
+  t0, t1: double;
+  checkResult: integer;
+
+procedure Bump(var v: integer; delta: integer);
+begin
+  v := (v + delta) mod 1009;
+end;
+
+function Nth(p: PNode; n: integer): PNode;
+begin
+  while n > 0 do
+  begin
+    p := p^.next;
+    n := n - 1;
+  end;
+  Nth := p;
+end;
+
+function Kernel: integer;
+var
+  head, node, p, q: PNode;
+  i, r, k, acc: integer;
+begin
+  head := nil;
+  for i := 1 to NODES do
+  begin
+    new(node);
+    node^.val := (i * 37) mod 1009;
+    node^.next := head;
+    head := node;
+  end;
+
+  acc := 0;
+  for r := 1 to ROUNDS do
+  begin
+    p := head;
+    k := 0;
+    while p <> nil do
+    begin
+      k := k + 1;
+      Bump(p^.val, r mod 5);
+      acc := (acc + p^.val * (k mod 7 + 1)) mod 1000003;
+      p := p^.next;
+    end;
+    q := Nth(head, r mod NODES);
+    acc := (acc + q^.val) mod 1000003;
+  end;
+
+  while head <> nil do
+  begin
+    p := head^.next;
+    dispose(head);
+    head := p;
+  end;
+  Kernel := acc;
+end;
+
+begin
+  t0 := RealTimeClock();
+  checkResult := Kernel;
+  t1 := RealTimeClock();
+  writeln('check=', checkResult);
+  writeln('elapsed_s=', (t1 - t0):0:6);
+end.
@@ -70,6 +70,43 @@ BENCHES = {
     # growable stack (deep_recursion.p's countdown(50000) would have hit
     # the old fixed VM_CALL_STACK_MAX=4096 within a couple thousand frames).
     "deep_recursion": ("deep_recursion.p", "1000000"),
+    # Element/field store loops (plan §12.5): every `a[i] := v` and
+    # `r.f := v` goes through an address push plus SET_INDIRECT. Expected
+    # value derived via a Python re-simulation of Kernel() (all
+    # intermediates stay well inside 32-bit range); not yet confirmed
+    # against a VM run.
+    "stores": ("stores.p", "655981"),
+    # Per-character string read/rewrite loop (plan §12.6). Expected value
+    # from a Python re-simulation of Kernel(); not yet confirmed against a
+    # VM run.
+    "strchars": ("strchars.p", "508519"),
+    # Enum state machine (plan §12.7). Expected value from a Python
+    # re-simulation of Kernel() with ordinals standing in for the enum;
+    # not yet confirmed against a VM run.
+    "enums": ("enums.p", "65019"),
+    # Linked-list traversal with var-parameter updates (plan §12.8).
+    # Expected value from a Python re-simulation of Kernel() (a list
+    # standing in for the linked nodes, head = last node created); not yet
+    # confirmed against a VM run.
+    "pointers": ("pointers.p", "150019"),
+    # Non-escaping local records (plan §12.13). Expected value from a
+    # Python re-simulation of Kernel() using truncating `mod` for the
+    # negative intermediates, matching Pascal's sign-of-dividend rule; not
+    # yet confirmed against a VM run.
+    "localrec": ("localrec.p", "889239"),
+    # Bouncing particles in a global fixed array of records (plan §12.16).
+    # Expected value from a Python re-simulation of Kernel() (positions
+    # stay inside the box, so no intermediate leaves 32-bit range); not
+    # yet confirmed against a VM run.
+    "particles": ("particles.p", "122658"),
+    # Character-at-a-time string building (plan §12.18). Expected value
+    # from a Python re-simulation of Kernel(); not yet confirmed against a
+    # VM run.
+    "append": ("append.p", "204398"),
+    # Character classification against set literals (plan §12.21).
+    # Expected value from a Python re-simulation of Kernel() (Python sets
+    # standing in for `set of char`); not yet confirmed against a VM run.
+    "sets": ("sets.p", "757800"),
 }
 
 CHECK_RE = re.compile(r"^check=(\S+)$", re.M)
@@ -0,0 +1,57 @@
+program BenchSets;
+{ Tokenizer-style character classification: `c in [...]` against set
+  literals, plus per-round set union and intersection over `set of char`.
+  Every literal is rebuilt from MAKE_SET_RANGE/MAKE_SET_SINGLETON and ADD
+  on each evaluation today, and IN scans the member list.  Baseline for
+  bitset sets (plan.md §12.21). }
+
+const
+  ROUNDS = 300;
+  LEN = 2000;
+
+var
+  src: string;
+  t0, t1: double;
+  checkResult: integer;
+
+function Kernel: integer;
+var
+  r, i, k, acc: integer;
+  c: char;
+  seen, common: set of char;
+begin
+  src := '';
+  for i := 1 to LEN do
+    src := src + chr(32 + (i * i * 7 + i * 13) mod 95);
+  acc := 0;
+  for r := 1 to ROUNDS do
+  begin
+    seen := [];
+    for i := 1 to LEN do
+    begin
+      c := src[i];
+      if c in ['a'..'z', 'A'..'Z', '_'] then
+        acc := acc + 1
+      else if c in ['0'..'9'] then
+        acc := acc + 3
+      else if c in [' ', '(', ')', '+', '-', '*', '/'] then
+        acc := acc + 5;
+      if (i + r) mod 7 = 0 then
+        seen := seen + [c];
+    end;
+    common := seen * ['a'..'z'];
+    for k := 0 to 255 do
+      if chr(k) in common then
+        acc := acc + k mod 11;
+    acc := acc mod 1000003;
+  end;
+  Kernel := acc;
+end;
+
+begin
+  t0 := RealTimeClock();
+  checkResult := Kernel;
+  t1 := RealTimeClock();
+  writeln('check=', checkResult);
+  writeln('elapsed_s=', (t1 - t0):0:6);
+end.
@@ -0,0 +1,61 @@
+program BenchStores;
+{ Store-heavy loops: indexed writes into a global array, a local array
+  and fields of a local array of records, one store per statement.
+  Every store lowers to an address push (GET_GSLOT_ADDRESS /
+  GET_LOCAL_ADDRESS, GET_ELEMENT_ADDRESS, GET_FIELD_OFFSET) followed by
+  SET_INDIRECT, and each address push allocates a PointerObj.  Reads go
+  through the fused LOAD_ELEMENT_VALUE/LOAD_FIELD_VALUE forms, so the
+  store side dominates.  Baseline for the fused store opcodes
+  (plan.md §12.5). }
+
+const
+  N = 256;
+  ROUNDS = 2000;
+
+type
+  TPoint = record
+    x: integer;
+    y: integer;
+  end;
+
+var
+  t0, t1: double;
+  gArr: array[1..N] of integer;
+  checkResult: integer;
+
+function Kernel: integer;
+var
+  local: array[1..N] of integer;
+  pts: array[1..N] of TPoint;
+  i, r, acc: integer;
+begin
+  for i := 1 to N do
+  begin
+    gArr[i] := i;
+    local[i] := N - i;
+    pts[i].x := i mod 17;
+    pts[i].y := i mod 23;
+  end;
+
+  for r := 1 to ROUNDS do
+    for i := 1 to N do
+    begin
+      gArr[i] := (gArr[i] + local[i] + r) mod 10007;
+      local[i] := (local[i] + gArr[i]) mod 10009;
+      pts[i].x := (pts[i].x + gArr[i]) mod 1009;
+      pts[i].y := (pts[i].y + pts[i].x + i) mod 1013;
+    end;
+
+  acc := 0;
+  for i := 1 to N do
+    acc := (acc + gArr[i] * 3 + local[i] * 5 + pts[i].x * 7 + pts[i].y * 11) mod 1000003;
+  Kernel := acc;
+end;
+
+begin
+  t0 := RealTimeClock();
+  checkResult := Kernel;
+  t1 := RealTimeClock();
+  writeln('check=', checkResult);
+  writeln('elapsed_s=', (t1 - t0):0:6);
+end.
@@ -0,0 +1,49 @@
+program BenchStrChars;
+{ Character-level string rewriting: a rotating case-flip cipher over one
+  string, read and rewritten in place a character at a time.  Every
+  `c := s[i]` is a string push plus GET_CHAR_FROM_STRING, and every
+  `s[i] := c` is GET_CHAR_ADDRESS (uniqueness check, pointer into the
+  buffer, PointerObj) plus SET_INDIRECT.  Baseline for the direct
+  string-char opcodes (plan.md §12.6). }
+
+const
+  LEN = 240;
+  ROUNDS = 3000;
+
+var
+  t0, t1: double;
+  checkResult: integer;
+
+function Kernel: integer;
+var
+  s: string;
+  c: char;
+  i, r, acc: integer;
+begin
+  s := '';
+  for i := 1 to LEN do
+    s := s + chr(ord('a') + (i * 7) mod 26);
+
+  acc := 0;
+  for r := 1 to ROUNDS do
+  begin
+    for i := 1 to LEN do
+    begin
+      c := s[i];
+      if (c >= 'a') and (c <= 'z') then
+        s[i] := chr(ord('A') + (ord(c) - ord('a') + r) mod 26)
+      else
+        s[i] := chr(ord('a') + (ord(c) - ord('A') + 3) mod 26);
+    end;
+    acc := (acc + ord(s[(r mod LEN) + 1]) * r) mod 1000003;
+  end;
+  Kernel := acc;
+end;
+
+begin
+  t0 := RealTimeClock();
+  checkResult := Kernel;
+  t1 := RealTimeClock();
+  writeln('check=', checkResult);
+  writeln('elapsed_s=', (t1 - t0):0:6);
+end.